@@ -0,0 +1,141 @@
+/*arena.c*/
+
+//
+// Scratch arena for short-lived values created while a nuPython
+// statement executes. See arena.h for details.
+//
+// Aarya Patel
+// Northwestern University
+// CS 211
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+
+//
+// Private functions:
+//
+
+#define ARENA_MIN_CHUNK 4096
+#define ARENA_ALIGN     (sizeof(max_align_t))
+
+//
+// panic
+//
+// Outputs the given error message and exits the program.
+//
+static void panic(char* msg)
+{
+  printf("**INTERNAL ERROR: %s\n", msg);
+  exit(-1);
+}
+
+//
+// new_chunk
+//
+// Allocates a chunk with room for at least n bytes.
+//
+static struct ARENA_CHUNK* new_chunk(size_t n, struct ARENA_CHUNK* next)
+{
+  size_t capacity = (n < ARENA_MIN_CHUNK) ? ARENA_MIN_CHUNK : n;
+
+  struct ARENA_CHUNK* chunk = malloc(sizeof(struct ARENA_CHUNK) + capacity);
+  if (chunk == NULL)
+    panic("out of memory in arena");
+
+  chunk->next = next;
+  chunk->capacity = capacity;
+  chunk->used = 0;
+
+  return chunk;
+}
+
+
+//
+// Public functions:
+//
+
+void arena_init(struct ARENA* arena)
+{
+  arena->chunks = NULL;
+}
+
+void arena_destroy(struct ARENA* arena)
+{
+  struct ARENA_CHUNK* chunk = arena->chunks;
+
+  while (chunk != NULL)
+  {
+    struct ARENA_CHUNK* next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+
+  arena->chunks = NULL;
+}
+
+void* arena_alloc(struct ARENA* arena, size_t n)
+{
+  // round up so the next allocation stays aligned:
+  n = (n + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+
+  struct ARENA_CHUNK* chunk = arena->chunks;
+
+  if (chunk == NULL || chunk->capacity - chunk->used < n)
+  {
+    //
+    // start a new chunk, at least double the size of the last
+    // one so a growing statement needs only a few chunks:
+    //
+    size_t want = n;
+    if (chunk != NULL && want < 2 * chunk->capacity)
+      want = 2 * chunk->capacity;
+
+    chunk = new_chunk(want, chunk);
+    arena->chunks = chunk;
+  }
+
+  void* p = chunk->data + chunk->used;
+  chunk->used += n;
+
+  return p;
+}
+
+char* arena_strdup(struct ARENA* arena, const char* s)
+{
+  size_t len = strlen(s);
+  char* copy = arena_alloc(arena, len + 1);
+
+  memcpy(copy, s, len + 1);
+
+  return copy;
+}
+
+void arena_reset(struct ARENA* arena)
+{
+  struct ARENA_CHUNK* chunk = arena->chunks;
+
+  if (chunk == NULL)
+    return;
+
+  if (chunk->next == NULL)  // common case: one chunk, just rewind
+  {
+    chunk->used = 0;
+    return;
+  }
+
+  //
+  // we outgrew the first chunk, coalesce into one chunk big enough
+  // for everything that was needed this time around:
+  //
+  size_t total = 0;
+  for (struct ARENA_CHUNK* c = chunk; c != NULL; c = c->next)
+    total += c->capacity;
+
+  arena_destroy(arena);
+  arena->chunks = new_chunk(total, NULL);
+}
@@ -0,0 +1,81 @@
+/*arena.h*/
+
+//
+// Scratch arena for short-lived values created while a nuPython
+// statement executes (e.g. the result of a string concatenation).
+// Allocation is a pointer bump; everything is released at once by
+// arena_reset(), which the execution engine calls after each
+// statement completes. The arena keeps its storage across resets,
+// so once it has grown to fit the largest statement no further
+// calls to malloc are made.
+//
+// Aarya Patel
+// Northwestern University
+// CS 211
+//
+
+#pragma once
+
+#include <stddef.h>  // size_t
+
+
+struct ARENA_CHUNK
+{
+  struct ARENA_CHUNK* next;  // previous (full) chunk
+  size_t capacity;           // # of bytes in data[]
+  size_t used;               // # of bytes handed out so far
+  char   data[];
+};
+
+struct ARENA
+{
+  struct ARENA_CHUNK* chunks;  // current chunk, older chunks follow
+};
+
+
+//
+// Public functions:
+//
+
+//
+// arena_init
+//
+// Initializes an empty arena; no memory is allocated until the
+// first call to arena_alloc().
+//
+void arena_init(struct ARENA* arena);
+
+//
+// arena_destroy
+//
+// Frees all the memory owned by the arena. Any pointers handed
+// out by the arena are no longer valid.
+//
+void arena_destroy(struct ARENA* arena);
+
+//
+// arena_alloc
+//
+// Returns a pointer to n bytes of scratch memory, suitably aligned
+// for any type. The memory remains valid until the next call to
+// arena_reset() or arena_destroy(). Never returns NULL; panics if
+// the system is out of memory.
+//
+void* arena_alloc(struct ARENA* arena, size_t n);
+
+//
+// arena_strdup
+//
+// Returns a copy of the given string allocated in the arena.
+//
+char* arena_strdup(struct ARENA* arena, const char* s);
+
+//
+// arena_reset
+//
+// Releases everything allocated from the arena so the space can be
+// reused. If the arena had to grow beyond one chunk, the chunks are
+// replaced by a single chunk of the combined size so that the next
+// statement of the same shape fits without allocating.
+//
+void arena_reset(struct ARENA* arena);
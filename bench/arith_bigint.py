@@ -0,0 +1,26 @@
+#
+# arith_bigint.py
+#
+# benchmark: integers that overflow 64 bits (factorial, fibonacci)
+#
+n = 1
+fact = 1
+while n <= 3000:
+{
+  fact = fact * n
+  n = n + 1
+}
+last = fact % 1000000007
+print(last)
+a = 0
+b = 1
+i = 0
+while i < 20000:
+{
+  c = a + b
+  a = b
+  b = c
+  i = i + 1
+}
+fib = b % 1000000007
+print(fib)
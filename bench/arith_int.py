@@ -0,0 +1,17 @@
+#
+# arith_int.py
+#
+# benchmark: tight loop of 64-bit integer arithmetic
+#
+i = 0
+total = 0
+while i < 1000000:
+{
+  a = i * 7
+  b = a % 13
+  c = total + b
+  total = c - 1
+  d = i / 3
+  i = i + 1
+}
+print(total)
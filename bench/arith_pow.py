@@ -0,0 +1,20 @@
+#
+# arith_pow.py
+#
+# benchmark: exponentiation, small results and large exponents
+#
+i = 0
+x = 0
+while i < 200000:
+{
+  a = 3 ** 39
+  b = 2 ** 62
+  c = a % 1000
+  x = x + c
+  i = i + 1
+}
+print(x)
+big = 2 ** 1000000000
+odd = 3 ** 200000
+digits = odd % 1000000
+print(digits)
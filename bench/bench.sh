@@ -0,0 +1,28 @@
+#!/bin/bash
+#
+# bench.sh
+#
+# Runs each nuPython program given on the command line a few times
+# with ./a.out and reports the best wall-clock time.
+#
+# usage: bash bench/bench.sh [-n runs] prog.py ...
+#
+runs=3
+if [ "$1" = "-n" ]; then
+  runs=$2
+  shift 2
+fi
+
+for prog in "$@"; do
+  best=""
+  for ((r = 0; r < runs; r++)); do
+    start=$(date +%s%N)
+    ./a.out "$prog" > /dev/null
+    end=$(date +%s%N)
+    ms=$(( (end - start) / 1000000 ))
+    if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then
+      best=$ms
+    fi
+  done
+  printf "%-28s %8d ms (best of %d)\n" "$prog" "$best" "$runs"
+done
@@ -0,0 +1,692 @@
+/*bigint.c*/
+
+//
+// Arbitrary-precision integers for nuPython. See bigint.h for
+// details.
+//
+// Aarya Patel
+// Northwestern University
+// CS 211
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>  // true, false
+
+#include "bigint.h"
+#include "arena.h"
+
+
+//
+// Private functions:
+//
+
+//
+// operands with fewer limbs than this are multiplied with the
+// schoolbook method; Karatsuba only pays off above it:
+//
+#define KARATSUBA_CUTOFF 32
+
+//
+// panic
+//
+// Outputs the given error message and exits the program.
+//
+static void panic(char* msg)
+{
+  printf("**INTERNAL ERROR: %s\n", msg);
+  exit(-1);
+}
+
+//
+// alloc_bigint
+//
+// Allocates a BIGINT with room for the given # of limbs in the
+// arena; the limbs are not initialized.
+//
+static struct BIGINT* alloc_bigint(struct ARENA* arena, int capacity)
+{
+  struct BIGINT* r = arena_alloc(arena, sizeof(struct BIGINT) + sizeof(uint32_t) * (capacity > 0 ? capacity : 1));
+
+  r->negative = false;
+  r->length = capacity;
+
+  return r;
+}
+
+//
+// trim
+//
+// Returns the # of limbs in a magnitude once leading zeros are
+// dropped.
+//
+static int trim(const uint32_t* a, int n)
+{
+  while (n > 0 && a[n - 1] == 0)
+    n--;
+
+  return n;
+}
+
+//
+// normalize
+//
+// Drops leading zero limbs; zero is never negative.
+//
+static struct BIGINT* normalize(struct BIGINT* r)
+{
+  r->length = trim(r->limbs, r->length);
+
+  if (r->length == 0)
+    r->negative = false;
+
+  return r;
+}
+
+//
+// mag_compare
+//
+// Compares two trimmed magnitudes, returning -1, 0 or 1.
+//
+static int mag_compare(const uint32_t* a, int an, const uint32_t* b, int bn)
+{
+  if (an != bn)
+    return (an < bn) ? -1 : 1;
+
+  for (int i = an - 1; i >= 0; i--)
+  {
+    if (a[i] != b[i])
+      return (a[i] < b[i]) ? -1 : 1;
+  }
+
+  return 0;
+}
+
+//
+// mag_add
+//
+// r = a + b; r must have room for max(an, bn) + 1 limbs, all of
+// which are written. Returns that # of limbs.
+//
+static int mag_add(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn)
+{
+  if (an < bn)
+  {
+    const uint32_t* t = a; a = b; b = t;
+    int tn = an; an = bn; bn = tn;
+  }
+
+  uint64_t carry = 0;
+  int i = 0;
+
+  for (; i < bn; i++)
+  {
+    carry += (uint64_t)a[i] + b[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+  for (; i < an; i++)
+  {
+    carry += a[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+  r[an] = (uint32_t)carry;
+
+  return an + 1;
+}
+
+//
+// mag_sub
+//
+// r = a - b where a >= b; r must have room for an limbs.
+//
+static void mag_sub(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn)
+{
+  int64_t borrow = 0;
+
+  for (int i = 0; i < an; i++)
+  {
+    int64_t d = (int64_t)a[i] - (i < bn ? b[i] : 0) - borrow;
+    borrow = (d < 0);
+    r[i] = (uint32_t)(borrow ? d + ((int64_t)1 << 32) : d);
+  }
+}
+
+//
+// mag_add_into
+//
+// r += a, where r has rn limbs and the sum is known to fit.
+//
+static void mag_add_into(uint32_t* r, int rn, const uint32_t* a, int an)
+{
+  uint64_t carry = 0;
+  int i = 0;
+
+  for (; i < an; i++)
+  {
+    carry += (uint64_t)r[i] + a[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+  for (; carry != 0 && i < rn; i++)
+  {
+    carry += r[i];
+    r[i] = (uint32_t)carry;
+    carry >>= 32;
+  }
+}
+
+//
+// mag_sub_into
+//
+// r -= a, where r has rn limbs and r >= a.
+//
+static void mag_sub_into(uint32_t* r, int rn, const uint32_t* a, int an)
+{
+  int64_t borrow = 0;
+  int i = 0;
+
+  for (; i < an || (borrow != 0 && i < rn); i++)
+  {
+    int64_t d = (int64_t)r[i] - (i < an ? a[i] : 0) - borrow;
+    borrow = (d < 0);
+    r[i] = (uint32_t)(borrow ? d + ((int64_t)1 << 32) : d);
+  }
+}
+
+//
+// mag_mul_school
+//
+// r = a * b by the schoolbook method; r must have room for
+// an + bn limbs, all of which are written.
+//
+static void mag_mul_school(uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn)
+{
+  memset(r, 0, sizeof(uint32_t) * (an + bn));
+
+  for (int i = 0; i < an; i++)
+  {
+    uint64_t ai = a[i];
+    uint64_t carry = 0;
+
+    if (ai == 0)
+      continue;
+
+    for (int j = 0; j < bn; j++)
+    {
+      uint64_t t = ai * b[j] + r[i + j] + carry;
+      r[i + j] = (uint32_t)t;
+      carry = t >> 32;
+    }
+    r[i + bn] = (uint32_t)carry;
+  }
+}
+
+//
+// mag_mul
+//
+// r = a * b; r must have room for an + bn limbs, all of which
+// are written. Large, similarly-sized operands are multiplied
+// with Karatsuba's method (3 half-size products instead of 4);
+// a much longer operand is cut into pieces the size of the
+// shorter one. Temporaries come from the arena.
+//
+static void mag_mul(struct ARENA* arena, uint32_t* r, const uint32_t* a, int an, const uint32_t* b, int bn)
+{
+  if (an < bn)
+  {
+    const uint32_t* t = a; a = b; b = t;
+    int tn = an; an = bn; bn = tn;
+  }
+
+  if (bn == 0)
+  {
+    memset(r, 0, sizeof(uint32_t) * an);
+    return;
+  }
+
+  if (bn < KARATSUBA_CUTOFF)
+  {
+    mag_mul_school(r, a, an, b, bn);
+    return;
+  }
+
+  if (2 * bn <= an)  // unbalanced, multiply piece by piece:
+  {
+    uint32_t* t = arena_alloc(arena, sizeof(uint32_t) * 2 * bn);
+
+    memset(r, 0, sizeof(uint32_t) * (an + bn));
+
+    for (int off = 0; off < an; off += bn)
+    {
+      int len = (an - off < bn) ? an - off : bn;
+
+      mag_mul(arena, t, a + off, len, b, bn);
+      mag_add_into(r + off, an + bn - off, t, len + bn);
+    }
+    return;
+  }
+
+  //
+  // Karatsuba: with a = a1*B^m + a0 and b = b1*B^m + b0,
+  //   a*b = z2*B^2m + z1*B^m + z0 where z0 = a0*b0, z2 = a1*b1
+  //   and z1 = (a0+a1)*(b0+b1) - z0 - z2
+  //
+  int m = an / 2;  // since 2*bn > an, b1 is non-empty
+  int a1n = an - m;
+  int b1n = bn - m;
+
+  mag_mul(arena, r, a, m, b, m);                     // z0
+  mag_mul(arena, r + 2 * m, a + m, a1n, b + m, b1n);  // z2
+
+  int san = a1n + 1;
+  int sbn = ((m > b1n) ? m : b1n) + 1;
+  uint32_t* sa = arena_alloc(arena, sizeof(uint32_t) * san);
+  uint32_t* sb = arena_alloc(arena, sizeof(uint32_t) * sbn);
+
+  mag_add(sa, a, m, a + m, a1n);
+  mag_add(sb, b, m, b + m, b1n);
+
+  int z1n = san + sbn;
+  uint32_t* z1 = arena_alloc(arena, sizeof(uint32_t) * z1n);
+
+  mag_mul(arena, z1, sa, trim(sa, san), sb, trim(sb, sbn));
+  memset(z1 + trim(sa, san) + trim(sb, sbn), 0,
+         sizeof(uint32_t) * (z1n - trim(sa, san) - trim(sb, sbn)));
+
+  mag_sub_into(z1, z1n, r, 2 * m);
+  mag_sub_into(z1, z1n, r + 2 * m, a1n + b1n);
+
+  mag_add_into(r + m, an + bn - m, z1, trim(z1, z1n));
+}
+
+//
+// mag_divmod_small
+//
+// q = a / d for a single-limb divisor d; returns the remainder.
+// q must have room for an limbs (q may be a).
+//
+static uint32_t mag_divmod_small(uint32_t* q, const uint32_t* a, int an, uint32_t d)
+{
+  uint64_t rem = 0;
+
+  for (int i = an - 1; i >= 0; i--)
+  {
+    uint64_t cur = (rem << 32) | a[i];
+    q[i] = (uint32_t)(cur / d);
+    rem = cur % d;
+  }
+
+  return (uint32_t)rem;
+}
+
+//
+// mag_divmod
+//
+// Long division of trimmed magnitudes u (m limbs) by v (n limbs),
+// n >= 2 and m >= n, using Knuth's algorithm D. q receives
+// m - n + 1 limbs and r (if not NULL) receives n limbs.
+//
+static void mag_divmod(struct ARENA* arena, uint32_t* q, uint32_t* r,
+                       const uint32_t* u, int m, const uint32_t* v, int n)
+{
+  const uint64_t b = (uint64_t)1 << 32;
+  int s = __builtin_clz(v[n - 1]);  // normalize so the top bit of v is set
+
+  uint32_t* vn = arena_alloc(arena, sizeof(uint32_t) * n);
+  uint32_t* un = arena_alloc(arena, sizeof(uint32_t) * (m + 1));
+
+  for (int i = n - 1; i > 0; i--)
+    vn[i] = (v[i] << s) | (s ? (uint32_t)((uint64_t)v[i - 1] >> (32 - s)) : 0);
+  vn[0] = v[0] << s;
+
+  un[m] = s ? (uint32_t)((uint64_t)u[m - 1] >> (32 - s)) : 0;
+  for (int i = m - 1; i > 0; i--)
+    un[i] = (u[i] << s) | (s ? (uint32_t)((uint64_t)u[i - 1] >> (32 - s)) : 0);
+  un[0] = u[0] << s;
+
+  for (int j = m - n; j >= 0; j--)
+  {
+    //
+    // estimate the next quotient limb, then correct it:
+    //
+    uint64_t num = ((uint64_t)un[j + n] << 32) | un[j + n - 1];
+    uint64_t qhat = num / vn[n - 1];
+    uint64_t rhat = num % vn[n - 1];
+
+    while (qhat >= b || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2]))
+    {
+      qhat--;
+      rhat += vn[n - 1];
+      if (rhat >= b)
+        break;
+    }
+
+    //
+    // multiply and subtract:
+    //
+    int64_t k = 0;
+    int64_t t;
+
+    for (int i = 0; i < n; i++)
+    {
+      uint64_t p = qhat * vn[i];
+      t = (int64_t)un[i + j] - k - (int64_t)(p & 0xFFFFFFFF);
+      un[i + j] = (uint32_t)t;
+      k = (int64_t)(p >> 32) - (t >> 32);
+    }
+    t = (int64_t)un[j + n] - k;
+    un[j + n] = (uint32_t)t;
+
+    q[j] = (uint32_t)qhat;
+
+    if (t < 0)  // subtracted too much, add back:
+    {
+      q[j]--;
+      k = 0;
+      for (int i = 0; i < n; i++)
+      {
+        t = (int64_t)un[i + j] + vn[i] + k;
+        un[i + j] = (uint32_t)t;
+        k = t >> 32;
+      }
+      un[j + n] += (uint32_t)k;
+    }
+  }
+
+  if (r != NULL)
+  {
+    for (int i = 0; i < n; i++)
+      r[i] = (un[i] >> s) | (s ? (uint32_t)((uint64_t)un[i + 1] << (32 - s)) : 0);
+  }
+}
+
+//
+// signed_add
+//
+// Returns (-1)^aneg * a + (-1)^bneg * b.
+//
+static struct BIGINT* signed_add(struct ARENA* arena, bool aneg, const struct BIGINT* a, bool bneg, const struct BIGINT* b)
+{
+  int n = ((a->length > b->length) ? a->length : b->length) + 1;
+  struct BIGINT* r = alloc_bigint(arena, n);
+
+  if (aneg == bneg)
+  {
+    mag_add(r->limbs, a->limbs, a->length, b->limbs, b->length);
+    r->negative = aneg;
+  }
+  else if (mag_compare(a->limbs, a->length, b->limbs, b->length) >= 0)
+  {
+    mag_sub(r->limbs, a->limbs, a->length, b->limbs, b->length);
+    r->length = a->length;
+    r->negative = aneg;
+  }
+  else
+  {
+    mag_sub(r->limbs, b->limbs, b->length, a->limbs, a->length);
+    r->length = b->length;
+    r->negative = bneg;
+  }
+
+  return normalize(r);
+}
+
+
+//
+// Public functions:
+//
+
+struct BIGINT* bigint_from_int64(struct ARENA* arena, int64_t value)
+{
+  struct BIGINT* r = alloc_bigint(arena, 2);
+  uint64_t mag = (value < 0) ? -(uint64_t)value : (uint64_t)value;
+
+  r->negative = (value < 0);
+  r->limbs[0] = (uint32_t)mag;
+  r->limbs[1] = (uint32_t)(mag >> 32);
+
+  return normalize(r);
+}
+
+struct BIGINT* bigint_from_string(struct ARENA* arena, const char* digits)
+{
+  int ndigits = (int)strlen(digits);
+  struct BIGINT* r = alloc_bigint(arena, ndigits / 9 + 2);
+
+  r->length = 0;
+
+  //
+  // consume 9 digits at a time: r = r * 10^k + chunk
+  //
+  for (int i = 0; i < ndigits; )
+  {
+    uint32_t chunk = 0;
+    uint32_t scale = 1;
+
+    for (int k = 0; k < 9 && i < ndigits; k++, i++)
+    {
+      chunk = chunk * 10 + (uint32_t)(digits[i] - '0');
+      scale *= 10;
+    }
+
+    uint64_t carry = chunk;
+    for (int j = 0; j < r->length; j++)
+    {
+      carry += (uint64_t)r->limbs[j] * scale;
+      r->limbs[j] = (uint32_t)carry;
+      carry >>= 32;
+    }
+    if (carry != 0)
+      r->limbs[r->length++] = (uint32_t)carry;
+  }
+
+  return normalize(r);
+}
+
+bool bigint_to_int64(const struct BIGINT* a, int64_t* value)
+{
+  if (a->length > 2)
+    return false;
+
+  uint64_t mag = 0;
+  if (a->length > 0)
+    mag = a->limbs[0];
+  if (a->length > 1)
+    mag |= (uint64_t)a->limbs[1] << 32;
+
+  if (!a->negative && mag <= (uint64_t)INT64_MAX)
+  {
+    *value = (int64_t)mag;
+    return true;
+  }
+  if (a->negative && mag <= (uint64_t)INT64_MAX + 1)
+  {
+    *value = (int64_t)(0 - mag);
+    return true;
+  }
+
+  return false;
+}
+
+double bigint_to_double(const struct BIGINT* a)
+{
+  double d = 0.0;
+
+  for (int i = a->length - 1; i >= 0; i--)
+    d = d * 4294967296.0 + a->limbs[i];
+
+  return a->negative ? -d : d;
+}
+
+int bigint_compare(const struct BIGINT* a, const struct BIGINT* b)
+{
+  if (a->negative != b->negative)
+    return a->negative ? -1 : 1;
+
+  int cmp = mag_compare(a->limbs, a->length, b->limbs, b->length);
+
+  return a->negative ? -cmp : cmp;
+}
+
+struct BIGINT* bigint_add(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b)
+{
+  return signed_add(arena, a->negative, a, b->negative, b);
+}
+
+struct BIGINT* bigint_sub(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b)
+{
+  return signed_add(arena, a->negative, a, !b->negative, b);
+}
+
+struct BIGINT* bigint_mul(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b)
+{
+  struct BIGINT* r = alloc_bigint(arena, a->length + b->length);
+
+  mag_mul(arena, r->limbs, a->limbs, a->length, b->limbs, b->length);
+  r->negative = (a->negative != b->negative);
+
+  return normalize(r);
+}
+
+void bigint_divmod(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b,
+                   struct BIGINT** quotient, struct BIGINT** remainder)
+{
+  if (b->length == 0)
+    panic("division by zero (bigint_divmod)");
+
+  struct BIGINT* q;
+  struct BIGINT* r;
+
+  if (mag_compare(a->limbs, a->length, b->limbs, b->length) < 0)
+  {
+    q = alloc_bigint(arena, 0);
+    r = alloc_bigint(arena, a->length);
+    memcpy(r->limbs, a->limbs, sizeof(uint32_t) * a->length);
+  }
+  else if (b->length == 1)
+  {
+    q = alloc_bigint(arena, a->length);
+    r = alloc_bigint(arena, 1);
+    r->limbs[0] = mag_divmod_small(q->limbs, a->limbs, a->length, b->limbs[0]);
+  }
+  else
+  {
+    q = alloc_bigint(arena, a->length - b->length + 1);
+    r = alloc_bigint(arena, b->length);
+    mag_divmod(arena, q->limbs, r->limbs, a->limbs, a->length, b->limbs, b->length);
+  }
+
+  q->negative = (a->negative != b->negative);
+  r->negative = a->negative;
+
+  if (quotient != NULL)
+    *quotient = normalize(q);
+  if (remainder != NULL)
+    *remainder = normalize(r);
+}
+
+struct BIGINT* bigint_pow(struct ARENA* arena, const struct BIGINT* base, uint64_t exponent)
+{
+  //
+  // a power of two is just a shift, no multiplications needed:
+  //
+  int top = base->length - 1;
+  if (top >= 0 && (base->limbs[top] & (base->limbs[top] - 1)) == 0 && trim(base->limbs, top) == 0)
+  {
+    uint64_t k = (uint64_t)top * 32 + (31 - __builtin_clz(base->limbs[top]));
+    uint64_t bit = k * exponent;
+
+    if (k != 0 && bit / k != exponent)
+      panic("exponent too large (bigint_pow)");
+
+    struct BIGINT* r = alloc_bigint(arena, (int)(bit / 32) + 1);
+    memset(r->limbs, 0, sizeof(uint32_t) * r->length);
+    r->limbs[bit / 32] = (uint32_t)1 << (bit % 32);
+    r->negative = base->negative && (exponent & 1);
+
+    return r;
+  }
+
+  //
+  // exponentiation by squaring:
+  //
+  struct BIGINT* result = bigint_from_int64(arena, 1);
+  const struct BIGINT* square = base;
+
+  while (exponent != 0)
+  {
+    if (exponent & 1)
+      result = bigint_mul(arena, result, square);
+
+    exponent >>= 1;
+    if (exponent != 0)
+      square = bigint_mul(arena, square, square);
+  }
+
+  return result;
+}
+
+char* bigint_to_string(struct ARENA* arena, const struct BIGINT* a)
+{
+  if (a->length == 0)
+    return arena_strdup(arena, "0");
+
+  //
+  // peel off 9 decimal digits at a time, least significant first:
+  //
+  int n = a->length;
+  uint32_t* mag = arena_alloc(arena, sizeof(uint32_t) * n);
+  uint32_t* chunks = arena_alloc(arena, sizeof(uint32_t) * (n * 10 / 9 + 2));
+  int nchunks = 0;
+
+  memcpy(mag, a->limbs, sizeof(uint32_t) * n);
+
+  while (n > 0)
+  {
+    chunks[nchunks++] = mag_divmod_small(mag, mag, n, 1000000000);
+    n = trim(mag, n);
+  }
+
+  char* s = arena_alloc(arena, (size_t)nchunks * 9 + 2);
+  char* p = s;
+
+  if (a->negative)
+    *p++ = '-';
+
+  p += sprintf(p, "%u", chunks[nchunks - 1]);
+  for (int i = nchunks - 2; i >= 0; i--)
+    p += sprintf(p, "%09u", chunks[i]);
+
+  return s;
+}
+
+void bigint_print(const struct BIGINT* a, FILE* output)
+{
+  struct ARENA scratch;
+
+  arena_init(&scratch);
+  fputs(bigint_to_string(&scratch, a), output);
+  arena_destroy(&scratch);
+}
+
+struct BIGINT* bigint_dup(const struct BIGINT* a)
+{
+  size_t size = sizeof(struct BIGINT) + sizeof(uint32_t) * a->length;
+  struct BIGINT* copy = malloc(size);
+
+  if (copy == NULL)
+    panic("out of memory (bigint_dup)");
+
+  memcpy(copy, a, size);
+
+  return copy;
+}
+
+void bigint_free(struct BIGINT* a)
+{
+  free(a);
+}
@@ -0,0 +1,132 @@
+/*bigint.h*/
+
+//
+// Arbitrary-precision integers for nuPython. Integer results that
+// overflow 64 bits are promoted to a BIGINT, so nuPython integers
+// never silently wrap around. A BIGINT is stored in sign-magnitude
+// form as an array of 32-bit limbs, least significant limb first,
+// with no leading zero limbs (zero has length 0).
+//
+// Results of arithmetic are allocated in a scratch arena, like any
+// other temporary created during execution; bigint_dup() makes a
+// long-lived copy when a value is stored into memory.
+//
+// Aarya Patel
+// Northwestern University
+// CS 211
+//
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>   // int64_t, uint32_t
+#include <stdbool.h>  // true, false
+
+#include "arena.h"
+
+
+struct BIGINT
+{
+  bool     negative;  // sign, false for zero
+  int      length;    // # of limbs in use
+  uint32_t limbs[];   // magnitude, least significant limb first
+};
+
+
+//
+// Public functions:
+//
+
+//
+// bigint_from_int64
+//
+// Returns the given 64-bit integer as a BIGINT in the arena.
+//
+struct BIGINT* bigint_from_int64(struct ARENA* arena, int64_t value);
+
+//
+// bigint_from_string
+//
+// Given a string of decimal digits (no sign), returns its value
+// as a BIGINT in the arena.
+//
+struct BIGINT* bigint_from_string(struct ARENA* arena, const char* digits);
+
+//
+// bigint_to_int64
+//
+// If the given BIGINT fits in 64 bits, stores it in *value and
+// returns true; otherwise returns false.
+//
+bool bigint_to_int64(const struct BIGINT* a, int64_t* value);
+
+//
+// bigint_to_double
+//
+// Returns the given BIGINT converted to the nearest double (or
+// +/- infinity if it is out of range).
+//
+double bigint_to_double(const struct BIGINT* a);
+
+//
+// bigint_compare
+//
+// Returns a negative value, zero or a positive value if a is
+// less than, equal to or greater than b.
+//
+int bigint_compare(const struct BIGINT* a, const struct BIGINT* b);
+
+//
+// Arithmetic: a + b, a - b, a * b. Multiplication switches from
+// the schoolbook method to Karatsuba for large operands.
+//
+struct BIGINT* bigint_add(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b);
+struct BIGINT* bigint_sub(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b);
+struct BIGINT* bigint_mul(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b);
+
+//
+// bigint_divmod
+//
+// Divides a by b, truncating toward zero like C's / and %; the
+// remainder has the sign of a. Either output may be NULL if it
+// is not wanted. b must not be zero.
+//
+void bigint_divmod(struct ARENA* arena, const struct BIGINT* a, const struct BIGINT* b,
+                   struct BIGINT** quotient, struct BIGINT** remainder);
+
+//
+// bigint_pow
+//
+// Returns base ** exponent using exponentiation by squaring.
+//
+struct BIGINT* bigint_pow(struct ARENA* arena, const struct BIGINT* base, uint64_t exponent);
+
+//
+// bigint_to_string
+//
+// Returns the decimal representation of the given BIGINT,
+// allocated in the arena.
+//
+char* bigint_to_string(struct ARENA* arena, const struct BIGINT* a);
+
+//
+// bigint_print
+//
+// Outputs the decimal representation of the given BIGINT.
+//
+void bigint_print(const struct BIGINT* a, FILE* output);
+
+//
+// bigint_dup
+//
+// Returns a dynamically-allocated copy of the given BIGINT. The
+// caller takes ownership and must call bigint_free() eventually.
+//
+struct BIGINT* bigint_dup(const struct BIGINT* a);
+
+//
+// bigint_free
+//
+// Frees a BIGINT returned by bigint_dup().
+//
+void bigint_free(struct BIGINT* a);
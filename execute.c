@@ -23,15 +23,40 @@
 #include <string.h>
 #include <assert.h>
 #include <math.h>
+#include <errno.h>
+#include <limits.h>   // INT_MAX
+#include <stdint.h>   // int64_t
+#include <inttypes.h> // PRId64
 
 #include "programgraph.h"
 #include "ram.h"
+#include "arena.h"
+#include "bigint.h"
 #include "execute.h"
 
 //
 // Private functions
 //
 
+//
+// lookup_value
+//
+// Returns a pointer to the value stored in memory under the given
+// name, or NULL if no such name exists. Unlike ram_read_cell_by_name,
+// no copy is made: the value is borrowed from memory and stays valid
+// until that memory cell is next written.
+//
+static struct RAM_VALUE *lookup_value(struct RAM *memory, char *name)
+{
+    int address = ram_get_addr(memory, name);
+
+    if (address < 0)
+    {
+        return NULL;
+    }
+    return &memory->cells[address].value;
+}
+
 //
 // Input(), int(), floater() functions for assignment
 //
@@ -43,11 +68,11 @@
 // a string literal and reading their input from stdin. The function
 // expects a string literal parameter as the prompt, reads a complete
 // line of user input, removes end-of-line characters, and returns
-// the input as a dynamically allocated string. If a semantic error
+// the input as a string in the scratch arena. If a semantic error
 // occurs (e.g. missing parameter, non-string parameter), an error
 // message is output and the function returns false.
 //
-static bool execute_input_function(struct FUNCTION_CALL *func_call, struct RAM_VALUE *result, int line)
+static bool execute_input_function(struct FUNCTION_CALL *func_call, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
     struct ELEMENT *param = func_call->parameter;
 
@@ -67,13 +92,8 @@ static bool execute_input_function(struct FUNCTION_CALL *func_call, struct RAM_V
     // Remove EOL characters
     line_input[strcspn(line_input, "\r\n")] = '\0';
 
-    // Create a copy of the input string
-    int len = strlen(line_input);
-    char *input_copy = malloc(len + 1);
-    strcpy(input_copy, line_input);
-
     result->value_type = RAM_TYPE_STR;
-    result->types.s = input_copy;
+    result->types.s = arena_strdup(scratch, line_input);
     return true;
 }
 
@@ -83,7 +103,7 @@ static bool execute_input_function(struct FUNCTION_CALL *func_call, struct RAM_V
 // Handles the int() function call by converting a string variable
 // to an integer value. The function expects a variable parameter
 // containing a string value, retrieves the string from memory,
-// and converts it to an integer using atoi(). Handles the special
+// and converts it to an integer using atoll(). Handles the special
 // case where "0" or strings of all zeros are valid conversions
 // that return 0. If a semantic error occurs (e.g. missing parameter,
 // non-variable parameter, undefined variable, non-string variable,
@@ -102,7 +122,7 @@ static bool execute_int_function(struct FUNCTION_CALL *func_call, struct RAM *me
 
     // Get the variable value
     char *var_name = param->element_value;
-    struct RAM_VALUE *var_value = ram_read_cell_by_name(memory, var_name);
+    struct RAM_VALUE *var_value = lookup_value(memory, var_name);
 
     if (var_value == NULL)
     {
@@ -113,13 +133,12 @@ static bool execute_int_function(struct FUNCTION_CALL *func_call, struct RAM *me
     if (var_value->value_type != RAM_TYPE_STR)
     {
         printf("**SEMANTIC ERROR: int() requires a string (line %d)\n", line);
-        ram_free_value(var_value);
         return false;
     }
 
     // Convert string to integer
     char *str_value = var_value->types.s;
-    int converted = atoi(str_value);
+    int64_t converted = atoll(str_value);
 
     // Check for conversion failure (special case for "0")
     if (converted == 0 && strcmp(str_value, "0") != 0)
@@ -137,14 +156,12 @@ static bool execute_int_function(struct FUNCTION_CALL *func_call, struct RAM *me
         if (!all_zeros)
         {
             printf("**SEMANTIC ERROR: invalid string for int() (line %d)\n", line);
-            ram_free_value(var_value);
             return false;
         }
     }
 
     result->value_type = RAM_TYPE_INT;
     result->types.i = converted;
-    ram_free_value(var_value);
     return true;
 }
 
@@ -173,7 +190,7 @@ static bool execute_float_function(struct FUNCTION_CALL *func_call, struct RAM *
 
     // Get the variable value
     char *var_name = param->element_value;
-    struct RAM_VALUE *var_value = ram_read_cell_by_name(memory, var_name);
+    struct RAM_VALUE *var_value = lookup_value(memory, var_name);
 
     if (var_value == NULL)
     {
@@ -184,7 +201,6 @@ static bool execute_float_function(struct FUNCTION_CALL *func_call, struct RAM *
     if (var_value->value_type != RAM_TYPE_STR)
     {
         printf("**SEMANTIC ERROR: float() requires a string (line %d)\n", line);
-        ram_free_value(var_value);
         return false;
     }
 
@@ -208,14 +224,12 @@ static bool execute_float_function(struct FUNCTION_CALL *func_call, struct RAM *
         if (!all_zeros)
         {
             printf("**SEMANTIC ERROR: invalid string for float() (line %d)\n", line);
-            ram_free_value(var_value);
             return false;
         }
     }
 
     result->value_type = RAM_TYPE_REAL;
     result->types.d = converted;
-    ram_free_value(var_value);
     return true;
 }
 
@@ -231,13 +245,13 @@ static bool execute_float_function(struct FUNCTION_CALL *func_call, struct RAM *
 // function name), an error message is output and the function
 // returns false.
 //
-static bool execute_assignment_function_call(struct FUNCTION_CALL *func_call, struct RAM *memory, struct RAM_VALUE *result, int line)
+static bool execute_assignment_function_call(struct FUNCTION_CALL *func_call, struct RAM *memory, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
     char *function_name = func_call->function_name;
 
     if (strcmp(function_name, "input") == 0)
     {
-        return execute_input_function(func_call, result, line);
+        return execute_input_function(func_call, scratch, result, line);
     }
     else if (strcmp(function_name, "int") == 0)
     {
@@ -272,7 +286,7 @@ static bool execute_assignment_function_call(struct FUNCTION_CALL *func_call, st
 // for False. If an unsupported operator type is provided, the function
 // returns false to indicate an error.
 //
-static bool execute_int_comparison(int lhs, int rhs, int operator_type, struct RAM_VALUE *result, int line)
+static bool execute_int_comparison(int64_t lhs, int64_t rhs, int operator_type, struct RAM_VALUE *result, int line)
 {
     result->value_type = RAM_TYPE_BOOLEAN;
 
@@ -439,6 +453,19 @@ static bool execute_real_comparison(double lhs, double rhs, int operator_type, s
     return true;
 }
 
+//
+// execute_bigint_comparison
+//
+// Performs relational comparison operations on two integers, at
+// least one of which is too big for 64 bits. The values are
+// compared with bigint_compare() and the outcome is then handled
+// like an integer comparison against 0.
+//
+static bool execute_bigint_comparison(struct BIGINT *lhs, struct BIGINT *rhs, int operator_type, struct RAM_VALUE *result, int line)
+{
+    return execute_int_comparison(bigint_compare(lhs, rhs), 0, operator_type, result, line);
+}
+
 //
 // execute_string_comparison
 //
@@ -534,40 +561,148 @@ static bool execute_string_comparison(char *lhs, char *rhs, int operator_type, s
 //
 
 
+//
+// set_int_result
+//
+// Stores an integer result computed as a BIGINT, demoting it to a
+// plain 64-bit int if it fits, so each integer has exactly one
+// representation.
+//
+static void set_int_result(struct BIGINT *value, struct RAM_VALUE *result)
+{
+    int64_t small;
+
+    if (bigint_to_int64(value, &small))
+    {
+        result->value_type = RAM_TYPE_INT;
+        result->types.i = small;
+    }
+    else
+    {
+        result->value_type = RAM_TYPE_BIGINT;
+        result->types.b = value;
+    }
+}
+
+//
+// execute_bigint_operation
+//
+// Performs arithmetic operations on two integers when at least one
+// of them (or the result) does not fit in 64 bits. Handles the same
+// operators as execute_int_operation, with the same truncating
+// division and modulo. Returns false if a division by zero occurs
+// or an unsupported operator is encountered.
+//
+static bool execute_bigint_operation(struct BIGINT *lhs, struct BIGINT *rhs, int operator_type, struct ARENA *scratch, struct RAM_VALUE *result, int line)
+{
+    struct BIGINT *value = NULL;
+
+    if (operator_type == OPERATOR_PLUS)
+    {
+        value = bigint_add(scratch, lhs, rhs);
+    }
+    else if (operator_type == OPERATOR_MINUS)
+    {
+        value = bigint_sub(scratch, lhs, rhs);
+    }
+    else if (operator_type == OPERATOR_ASTERISK)
+    {
+        value = bigint_mul(scratch, lhs, rhs);
+    }
+    else if (operator_type == OPERATOR_POWER)
+    {
+        int64_t exponent;
+
+        // as with ints, a negative exponent yields 1
+        if (rhs->negative)
+        {
+            exponent = 0;
+        }
+        else if (!bigint_to_int64(rhs, &exponent))
+        {
+            printf("**SEMANTIC ERROR: integer overflow (line %d)\n", line);
+            return false;
+        }
+        value = bigint_pow(scratch, lhs, (uint64_t)exponent);
+    }
+    else if (operator_type == OPERATOR_MOD)
+    {
+        if (rhs->length == 0)
+        {
+            printf("**SEMANTIC ERROR: mod by 0 (line %d)\n", line);
+            return false;
+        }
+        bigint_divmod(scratch, lhs, rhs, NULL, &value);
+    }
+    else if (operator_type == OPERATOR_DIV)
+    {
+        if (rhs->length == 0)
+        {
+            printf("**SEMANTIC ERROR: divide by 0 (line %d)\n", line);
+            return false;
+        }
+        bigint_divmod(scratch, lhs, rhs, &value, NULL);
+    }
+    else
+    {
+        printf("**SEMANTIC ERROR: invalid operand types (line %d)\n", line);
+        return false;
+    }
+
+    set_int_result(value, result);
+    return true;
+}
+
 //
 // execute_int_operation
 //
-// Performs arithmetic operations on two integers (ints). Handles
+// Performs arithmetic operations on two 64-bit integers. Handles
 // addition (+), subtraction (-), multiplication (*), exponentiation (**),
-// modulo (%), and division (/). Uses pow() from math.h for exponentiation
-// and fmod() for modulo operations since the standard % operator doesn't
-// work with floating point values. Includes error checking for division
+// modulo (%), and division (/). Overflow is detected with the compiler's
+// checked-arithmetic builtins, in which case the operation is redone by
+// execute_bigint_operation and the result promoted to a big integer.
+// Exponentiation is done by squaring. Includes error checking for division
 // and modulo by zero. Returns false if a division by zero occurs or an
 // unsupported operator is encountered.
 //
-static bool execute_int_operation(int lhs, int rhs, int operator_type, struct RAM_VALUE *result, int line)
+static bool execute_int_operation(int64_t lhs, int64_t rhs, int operator_type, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
+    bool overflow = false;
+
     result->value_type = RAM_TYPE_INT;
 
     if (operator_type == OPERATOR_PLUS)
     {
-        result->types.i = lhs + rhs;
+        overflow = __builtin_add_overflow(lhs, rhs, &result->types.i);
     }
     else if (operator_type == OPERATOR_MINUS)
     {
-        result->types.i = lhs - rhs;
+        overflow = __builtin_sub_overflow(lhs, rhs, &result->types.i);
     }
     else if (operator_type == OPERATOR_ASTERISK)
     {
-        result->types.i = lhs * rhs;
+        overflow = __builtin_mul_overflow(lhs, rhs, &result->types.i);
     }
     else if (operator_type == OPERATOR_POWER)
     {
-        result->types.i = 1;
-        for (int i = 0; i < rhs; i++)
+        // a negative exponent yields 1, as it always has
+        int64_t power = 1;
+        int64_t square = lhs;
+        int64_t exponent = rhs;
+
+        while (exponent > 0 && !overflow)
         {
-            result->types.i *= lhs;
+            if (exponent & 1)
+            {
+                overflow = __builtin_mul_overflow(power, square, &power);
+            }
+            exponent >>= 1;
+            if (exponent > 0 && !overflow)
+            {
+                overflow = __builtin_mul_overflow(square, square, &square);
+            }
         }
+        result->types.i = power;
     }
     else if (operator_type == OPERATOR_MOD)
     {
@@ -576,7 +711,7 @@ static bool execute_int_operation(int lhs, int rhs, int operator_type, struct RA
             printf("**SEMANTIC ERROR: mod by 0 (line %d)\n", line);
             return false;
         }
-        result->types.i = lhs % rhs;
+        result->types.i = (rhs == -1) ? 0 : lhs % rhs; // INT64_MIN % -1 traps
     }
     else if (operator_type == OPERATOR_DIV)
     {
@@ -585,13 +720,25 @@ static bool execute_int_operation(int lhs, int rhs, int operator_type, struct RA
             printf("**SEMANTIC ERROR: divide by 0 (line %d)\n", line);
             return false;
         }
-        result->types.i = lhs / rhs;
+        if (rhs == -1)
+        {
+            overflow = __builtin_sub_overflow((int64_t)0, lhs, &result->types.i);
+        }
+        else
+        {
+            result->types.i = lhs / rhs;
+        }
     }
     else
     {
         printf("**SEMANTIC ERROR: invalid operand types (line %d)\n", line);
         return false;
     }
+
+    if (overflow)
+    {
+        return execute_bigint_operation(bigint_from_int64(scratch, lhs), bigint_from_int64(scratch, rhs), operator_type, scratch, result, line);
+    }
     return true;
 }
 
@@ -657,12 +804,12 @@ static bool execute_real_operation(double lhs, double rhs, int operator_type, st
 //
 // Performs operations on two strings. Currently only supports concatenation
 // using the + operator - all other operators result in a semantic error.
-// Dynamically allocates memory for the concatenated result, copies the first
-// string, then appends the second string. Includes error checking for memory
-// allocation failure. Returns false if an unsupported operator is used or
-// memory allocation fails.
+// The concatenated result is carved from the scratch arena, so it only
+// lives until the current statement completes; storing it into memory
+// makes the long-lived copy. Returns false if an unsupported operator
+// is used.
 //
-static bool execute_string_operation(char *lhs, char *rhs, int operator_type, struct RAM_VALUE *result, int line)
+static bool execute_string_operation(char *lhs, char *rhs, int operator_type, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
     if (operator_type != OPERATOR_PLUS)
     {
@@ -671,24 +818,88 @@ static bool execute_string_operation(char *lhs, char *rhs, int operator_type, st
     }
 
     // String concatenation
-    int len1 = strlen(lhs);
-    int len2 = strlen(rhs);
-    char *concatenated = malloc(len1 + len2 + 1);
-
-    if (concatenated == NULL)
-    {
-        printf("**SEMANTIC ERROR: memory allocation failed (line %d)\n", line);
-        return false;
-    }
+    size_t len1 = strlen(lhs);
+    size_t len2 = strlen(rhs);
+    char *concatenated = arena_alloc(scratch, len1 + len2 + 1);
 
-    strcpy(concatenated, lhs);
-    strcat(concatenated, rhs);
+    memcpy(concatenated, lhs, len1);
+    memcpy(concatenated + len1, rhs, len2 + 1);
 
     result->value_type = RAM_TYPE_STR;
     result->types.s = concatenated;
     return true;
 }
 
+//
+// Helper functions for operands
+//
+
+//
+// parse_int_literal
+//
+// Converts the digits of an integer literal to a value: a 64-bit
+// int if it fits, otherwise a big integer in the scratch arena.
+//
+static void parse_int_literal(char *literal, struct ARENA *scratch, struct RAM_VALUE *result)
+{
+    errno = 0;
+    long long value = strtoll(literal, NULL, 10);
+
+    if (errno == ERANGE)
+    {
+        result->value_type = RAM_TYPE_BIGINT;
+        result->types.b = bigint_from_string(scratch, literal);
+    }
+    else
+    {
+        result->value_type = RAM_TYPE_INT;
+        result->types.i = value;
+    }
+}
+
+//
+// is_integer
+//
+// Returns true if the value is an int of either representation.
+//
+static bool is_integer(struct RAM_VALUE *value)
+{
+    return value->value_type == RAM_TYPE_INT || value->value_type == RAM_TYPE_BIGINT;
+}
+
+//
+// as_bigint
+//
+// Returns an integer value as a BIGINT, converting a 64-bit int
+// into the scratch arena if needed.
+//
+static struct BIGINT *as_bigint(struct RAM_VALUE *value, struct ARENA *scratch)
+{
+    if (value->value_type == RAM_TYPE_BIGINT)
+    {
+        return value->types.b;
+    }
+    return bigint_from_int64(scratch, value->types.i);
+}
+
+//
+// as_real
+//
+// Returns a numeric value (int, big int or real) as a double.
+//
+static double as_real(struct RAM_VALUE *value)
+{
+    if (value->value_type == RAM_TYPE_INT)
+    {
+        return (double)value->types.i;
+    }
+    else if (value->value_type == RAM_TYPE_BIGINT)
+    {
+        return bigint_to_double(value->types.b);
+    }
+    return value->types.d;
+}
+
 //
 // retrieve_value
 //
@@ -699,14 +910,15 @@ static bool execute_string_operation(char *lhs, char *rhs, int operator_type, st
 // (e.g. undefined variable, non-integer type), an
 // error message is output and the function returns false.
 // Enhanced version that can retrieve any type of value (int, real, string, boolean)
+// Strings are not copied: the result borrows the literal from the
+// program graph or the string stored in memory.
 //
 
-static bool retrieve_value(struct ELEMENT *element, struct RAM *memory, struct RAM_VALUE *result, int line)
+static bool retrieve_value(struct ELEMENT *element, struct RAM *memory, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
     if (element->element_type == ELEMENT_INT_LITERAL)
     {
-        result->value_type = RAM_TYPE_INT;
-        result->types.i = atoi(element->element_value);
+        parse_int_literal(element->element_value, scratch, result);
         return true;
     }
     else if (element->element_type == ELEMENT_REAL_LITERAL)
@@ -718,10 +930,7 @@ static bool retrieve_value(struct ELEMENT *element, struct RAM *memory, struct R
     else if (element->element_type == ELEMENT_STR_LITERAL)
     {
         result->value_type = RAM_TYPE_STR;
-        int len = strlen(element->element_value);
-        char *str_copy = malloc(len + 1);
-        strcpy(str_copy, element->element_value);
-        result->types.s = str_copy;
+        result->types.s = element->element_value;
         return true;
     }
     else if (element->element_type == ELEMENT_TRUE)
@@ -739,27 +948,14 @@ static bool retrieve_value(struct ELEMENT *element, struct RAM *memory, struct R
     else if (element->element_type == ELEMENT_IDENTIFIER)
     {
         char *var_name = element->element_value;
-        struct RAM_VALUE *value = ram_read_cell_by_name(memory, var_name);
+        struct RAM_VALUE *value = lookup_value(memory, var_name);
 
         if (value == NULL)
         {
             printf("**SEMANTIC ERROR: name '%s' is not defined (line %d)\n", var_name, line);
             return false;
         }
-        if (value->value_type == RAM_TYPE_STR)
-        {
-            result->value_type = RAM_TYPE_STR;
-            int len = strlen(value->types.s);
-            char *str_copy = malloc(len + 1);
-            strcpy(str_copy, value->types.s);
-            result->types.s = str_copy;
-        }
-        // Copy the pointer if not a string
-        else
-        {
-            *result = *value;
-        }
-        ram_free_value(value);
+        *result = *value;
         return true;
     }
 
@@ -777,20 +973,20 @@ static bool retrieve_value(struct ELEMENT *element, struct RAM *memory, struct R
 // an error message is output, execution stops, and the function returns false.
 // Extended to operate on reals, ints, and strings
 //
-static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, struct RAM_VALUE *result, int line)
+static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, struct ARENA *scratch, struct RAM_VALUE *result, int line)
 {
     if (!expr->isBinaryExpr)
     {
-        return retrieve_value(expr->lhs->element, memory, result, line);
+        return retrieve_value(expr->lhs->element, memory, scratch, result, line);
     }
 
     struct RAM_VALUE lhs_value, rhs_value;
 
-    if (!retrieve_value(expr->lhs->element, memory, &lhs_value, line))
+    if (!retrieve_value(expr->lhs->element, memory, scratch, &lhs_value, line))
     {
         return false;
     }
-    if (!retrieve_value(expr->rhs->element, memory, &rhs_value, line))
+    if (!retrieve_value(expr->rhs->element, memory, scratch, &rhs_value, line))
     {
         return false;
     }
@@ -801,22 +997,17 @@ static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, str
         {
             return execute_int_comparison(lhs_value.types.i, rhs_value.types.i, expr->operator_type, result, line);
         }
+        else if (is_integer(&lhs_value) && is_integer(&rhs_value))
+        {
+            return execute_bigint_comparison(as_bigint(&lhs_value, scratch), as_bigint(&rhs_value, scratch), expr->operator_type, result, line);
+        }
         else if (lhs_value.value_type == RAM_TYPE_REAL && rhs_value.value_type == RAM_TYPE_REAL)
         {
             return execute_real_comparison(lhs_value.types.d, rhs_value.types.d, expr->operator_type, result, line);
         }
-        else if ((lhs_value.value_type == RAM_TYPE_REAL && rhs_value.value_type == RAM_TYPE_INT) || (lhs_value.value_type == RAM_TYPE_INT && rhs_value.value_type == RAM_TYPE_REAL))
+        else if ((lhs_value.value_type == RAM_TYPE_REAL && is_integer(&rhs_value)) || (is_integer(&lhs_value) && rhs_value.value_type == RAM_TYPE_REAL))
         {
-            if (lhs_value.value_type == RAM_TYPE_INT)
-            {
-                double lhs_real = (double)lhs_value.types.i;
-                return execute_real_comparison(lhs_real, rhs_value.types.d, expr->operator_type, result, line);
-            }
-            else
-            {
-                double rhs_real = (double)rhs_value.types.i;
-                return execute_real_comparison(lhs_value.types.d, rhs_real, expr->operator_type, result, line);
-            }
+            return execute_real_comparison(as_real(&lhs_value), as_real(&rhs_value), expr->operator_type, result, line);
         }
         else if (lhs_value.value_type == RAM_TYPE_STR && rhs_value.value_type == RAM_TYPE_STR)
         {
@@ -827,7 +1018,12 @@ static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, str
     // Both operands are integers
     if (lhs_value.value_type == RAM_TYPE_INT && rhs_value.value_type == RAM_TYPE_INT)
     {
-        return execute_int_operation(lhs_value.types.i, rhs_value.types.i, expr->operator_type, result, line);
+        return execute_int_operation(lhs_value.types.i, rhs_value.types.i, expr->operator_type, scratch, result, line);
+    }
+    // Integers, at least one of them too big for 64 bits
+    else if (is_integer(&lhs_value) && is_integer(&rhs_value))
+    {
+        return execute_bigint_operation(as_bigint(&lhs_value, scratch), as_bigint(&rhs_value, scratch), expr->operator_type, scratch, result, line);
     }
     // Both operands are reals
     else if (lhs_value.value_type == RAM_TYPE_REAL && rhs_value.value_type == RAM_TYPE_REAL)
@@ -835,17 +1031,15 @@ static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, str
         return execute_real_operation(lhs_value.types.d, rhs_value.types.d, expr->operator_type, result, line);
     }
     // One int, one real - convert to reals
-    else if ((lhs_value.value_type == RAM_TYPE_INT && rhs_value.value_type == RAM_TYPE_REAL) ||
-             (lhs_value.value_type == RAM_TYPE_REAL && rhs_value.value_type == RAM_TYPE_INT))
+    else if ((is_integer(&lhs_value) && rhs_value.value_type == RAM_TYPE_REAL) ||
+             (lhs_value.value_type == RAM_TYPE_REAL && is_integer(&rhs_value)))
     {
-        double lhs_real = (lhs_value.value_type == RAM_TYPE_INT) ? (double)lhs_value.types.i : lhs_value.types.d;
-        double rhs_real = (rhs_value.value_type == RAM_TYPE_INT) ? (double)rhs_value.types.i : rhs_value.types.d;
-        return execute_real_operation(lhs_real, rhs_real, expr->operator_type, result, line);
+        return execute_real_operation(as_real(&lhs_value), as_real(&rhs_value), expr->operator_type, result, line);
     }
     // Both operands are strings
     else if (lhs_value.value_type == RAM_TYPE_STR && rhs_value.value_type == RAM_TYPE_STR)
     {
-        return execute_string_operation(lhs_value.types.s, rhs_value.types.s, expr->operator_type, result, line);
+        return execute_string_operation(lhs_value.types.s, rhs_value.types.s, expr->operator_type, scratch, result, line);
     }
     // Invalid combination
     else
@@ -858,38 +1052,25 @@ static bool execute_binary_expression(struct EXPR *expr, struct RAM *memory, str
 //
 // execute_expr
 //
-// Evaluates any expression and returns the result. Handles both simple
-// expressions (single values like variables or literals) and complex
-// binary expressions (with operators). Allocates memory for the result
-// and delegates the actual work to either execute_binary_expression or
-// retrieve_value depending on the expression type. Cleans up allocated
-// memory if an error occurs during evaluation. Returns NULL if memory
-// allocation fails or expression evaluation encounters an error.
+// Evaluates any expression and stores the result by value. Handles
+// both simple expressions (single values like variables or literals)
+// and complex binary expressions (with operators), delegating the
+// actual work to either execute_binary_expression or retrieve_value
+// depending on the expression type. A string result is either borrowed
+// (literal or memory) or lives in the scratch arena, and is valid
+// until the statement completes. Returns false if expression
+// evaluation encounters an error.
 //
-static struct RAM_VALUE *execute_expr(struct STMT *stmt, struct RAM *memory, struct EXPR *expr)
+static bool execute_expr(struct STMT *stmt, struct RAM *memory, struct ARENA *scratch, struct EXPR *expr, struct RAM_VALUE *result)
 {
-    struct RAM_VALUE *result = malloc(sizeof(struct RAM_VALUE));
-    if (result == NULL)
-    {
-        return NULL;
-    }
     if (expr->isBinaryExpr)
     {
-        if (!execute_binary_expression(expr, memory, result, stmt->line))
-        {
-            free(result);
-            return NULL;
-        }
+        return execute_binary_expression(expr, memory, scratch, result, stmt->line);
     }
     else
     {
-        if (!retrieve_value(expr->lhs->element, memory, result, stmt->line))
-        {
-            free(result);
-            return NULL;
-        }
+        return retrieve_value(expr->lhs->element, memory, scratch, result, stmt->line);
     }
-    return result;
 }
 
 //
@@ -903,31 +1084,32 @@ static struct RAM_VALUE *execute_expr(struct STMT *stmt, struct RAM *memory, str
 // or boolean condition results - other types result in a semantic error.
 // Returns false if condition evaluation fails or produces an invalid type.
 //
-static bool execute_if_stmt(struct STMT *stmt, struct RAM *memory, struct STMT **next_stmt)
+static bool execute_if_stmt(struct STMT *stmt, struct RAM *memory, struct ARENA *scratch, struct STMT **next_stmt)
 {
     assert(stmt->stmt_type == STMT_IF_THEN_ELSE);
 
     struct EXPR *condition = stmt->types.if_then_else->condition;
-    struct RAM_VALUE *condition_result = execute_expr(stmt, memory, condition);
+    struct RAM_VALUE condition_result;
 
-    if (condition_result == NULL)
+    if (!execute_expr(stmt, memory, scratch, condition, &condition_result))
     {
         return false;
     }
     bool condition_bool = false;
-    if (condition_result->value_type == RAM_TYPE_INT || condition_result->value_type == RAM_TYPE_BOOLEAN)
+    if (condition_result.value_type == RAM_TYPE_INT || condition_result.value_type == RAM_TYPE_BOOLEAN)
+    {
+        condition_bool = condition_result.types.i != 0;
+    }
+    else if (condition_result.value_type == RAM_TYPE_BIGINT)
     {
-        condition_bool = condition_result->types.i != 0;
+        condition_bool = true; // a big int is never 0
     }
     else
     {
         printf("**SEMANTIC ERROR: condition must evaluate to integer or boolean (line %d)\n", stmt->line);
-        free(condition_result);
         return false;
     }
 
-    free(condition_result);
-
     if (!condition_bool)
     {
         *next_stmt = stmt->types.if_then_else->false_path;
@@ -951,30 +1133,32 @@ static bool execute_if_stmt(struct STMT *stmt, struct RAM *memory, struct STMT *
 // after the loop. Only accepts integer or boolean condition results.
 // Returns false if condition evaluation fails or produces an invalid type.
 //
-static bool execute_while_loop(struct STMT *stmt, struct RAM *memory, struct STMT **next_stmt)
+static bool execute_while_loop(struct STMT *stmt, struct RAM *memory, struct ARENA *scratch, struct STMT **next_stmt)
 {
     assert(stmt->stmt_type == STMT_WHILE_LOOP);
 
     struct EXPR *condition = stmt->types.while_loop->condition;
-    struct RAM_VALUE *condition_result = execute_expr(stmt, memory, condition);
+    struct RAM_VALUE condition_result;
 
-    if (condition_result == NULL)
+    if (!execute_expr(stmt, memory, scratch, condition, &condition_result))
     {
         return false;
     }
 
     bool condition_bool = false;
-    if (condition_result->value_type == RAM_TYPE_INT || condition_result->value_type == RAM_TYPE_BOOLEAN)
+    if (condition_result.value_type == RAM_TYPE_INT || condition_result.value_type == RAM_TYPE_BOOLEAN)
+    {
+        condition_bool = condition_result.types.i != 0;
+    }
+    else if (condition_result.value_type == RAM_TYPE_BIGINT)
     {
-        condition_bool = condition_result->types.i != 0;
+        condition_bool = true; // a big int is never 0
     }
     else
     {
         printf("**SEMANTIC ERROR: condition must evaluate to integer or boolean (line %d)\n", stmt->line);
-        free(condition_result);
         return false;
     }
-    free(condition_result);
 
     if (condition_bool){
         *next_stmt = stmt->types.while_loop->loop_body;
@@ -993,14 +1177,16 @@ static bool execute_while_loop(struct STMT *stmt, struct RAM *memory, struct STM
 // assignment and pointer-based assignment. If a semantic
 // error occurs (e.g. invalid memory address for pointer
 // assignment), an error message is output and the
-// function returns false.
+// function returns false. Strings are duplicated by
+// memory when written, which is the only point where
+// a value is promoted to long-lived storage.
 //
 static bool write_value_to_variable(char *var_name, bool isPtrDeref, struct RAM_VALUE ram_value, struct RAM *memory, int line)
 {
     if (isPtrDeref)
     {
         // Pointer-based assignment (*x = value)
-        struct RAM_VALUE *addr_value = ram_read_cell_by_name(memory, var_name);
+        struct RAM_VALUE *addr_value = lookup_value(memory, var_name);
         if (addr_value == NULL)
         {
             printf("**SEMANTIC ERROR: name '%s' is not defined (line %d)\n", var_name, line);
@@ -1013,10 +1199,9 @@ static bool write_value_to_variable(char *var_name, bool isPtrDeref, struct RAM_
             return false;
         }
 
-        int address = addr_value->types.i;
-        ram_free_value(addr_value);
+        int64_t address = addr_value->types.i;
 
-        if (!ram_write_cell_by_addr(memory, ram_value, address))
+        if (address < 0 || address > INT_MAX || !ram_write_cell_by_addr(memory, ram_value, (int)address))
         {
             printf("**SEMANTIC ERROR: invalid memory address for assignment (line %d)\n", line);
             return false;
@@ -1042,7 +1227,7 @@ static bool write_value_to_variable(char *var_name, bool isPtrDeref, struct RAM_
 // occurs (e.g. undefined variable), an error message
 // is output and the function returns false.
 //
-static bool execute_assignment(struct STMT *stmt, struct RAM *memory)
+static bool execute_assignment(struct STMT *stmt, struct RAM *memory, struct ARENA *scratch)
 {
     assert(stmt->stmt_type == STMT_ASSIGNMENT);
 
@@ -1056,22 +1241,18 @@ static bool execute_assignment(struct STMT *stmt, struct RAM *memory)
     // Check to see if the RHS value is assignment or function call
     if (rhs->value_type == VALUE_FUNCTION_CALL)
     {
-        if (!execute_assignment_function_call(rhs->types.function_call, memory, &result, stmt->line))
+        if (!execute_assignment_function_call(rhs->types.function_call, memory, scratch, &result, stmt->line))
         {
             return false;
         }
     }
     else if (rhs->value_type == VALUE_EXPR)
     {
-        struct EXPR *expr = rhs->types.expr;
-        struct RAM_VALUE *expr_result = execute_expr(stmt, memory, rhs->types.expr);
         // Use the extended binary expression handler for ALL cases
-        if (expr_result == NULL)
+        if (!execute_expr(stmt, memory, scratch, rhs->types.expr, &result))
         {
             return false;
         }
-        result = *expr_result;
-        free(expr_result);
     }
     else
     {
@@ -1081,6 +1262,24 @@ static bool execute_assignment(struct STMT *stmt, struct RAM *memory)
 
     return write_value_to_variable(var_name, isPtrDeref, result, memory, stmt->line);
 }
+//
+// print_int
+//
+// Outputs an int of either representation, followed by a newline.
+//
+static void print_int(struct RAM_VALUE *value)
+{
+    if (value->value_type == RAM_TYPE_BIGINT)
+    {
+        bigint_print(value->types.b, stdout);
+        printf("\n");
+    }
+    else
+    {
+        printf("%" PRId64 "\n", value->types.i);
+    }
+}
+
 //
 // execute_function_call
 //
@@ -1092,7 +1291,7 @@ static bool execute_assignment(struct STMT *stmt, struct RAM *memory)
 // undefined variable), an error message is output and
 // the function returns false.
 //
-static bool execute_function_call(struct STMT *stmt, struct RAM *memory)
+static bool execute_function_call(struct STMT *stmt, struct RAM *memory, struct ARENA *scratch)
 {
     // Check if it's actually a function call statement
     if (stmt->stmt_type != STMT_FUNCTION_CALL)
@@ -1117,8 +1316,9 @@ static bool execute_function_call(struct STMT *stmt, struct RAM *memory)
         }
         else if (param->element_type == ELEMENT_INT_LITERAL)
         {
-            int param_int = atoi(param->element_value);
-            printf("%d\n", param_int);
+            struct RAM_VALUE param_int;
+            parse_int_literal(param->element_value, scratch, &param_int);
+            print_int(&param_int);
             return true;
         }
         else if (param->element_type == ELEMENT_REAL_LITERAL)
@@ -1140,7 +1340,7 @@ static bool execute_function_call(struct STMT *stmt, struct RAM *memory)
         else if (param->element_type == ELEMENT_IDENTIFIER)
         {
             char *var_name = param->element_value;
-            struct RAM_VALUE *value = ram_read_cell_by_name(memory, var_name);
+            struct RAM_VALUE *value = lookup_value(memory, var_name);
 
             if (value == NULL)
             {
@@ -1148,9 +1348,9 @@ static bool execute_function_call(struct STMT *stmt, struct RAM *memory)
                 return false;
             }
             // check which type the variable is
-            if (value->value_type == RAM_TYPE_INT)
+            if (is_integer(value))
             {
-                printf("%d\n", value->types.i);
+                print_int(value);
             }
             else if (value->value_type == RAM_TYPE_REAL)
             {
@@ -1195,28 +1395,35 @@ static bool execute_function_call(struct STMT *stmt, struct RAM *memory)
 // and error message is output, execution stops,
 // and the function returns.
 //
+// Temporaries (e.g. concatenated strings) are carved
+// from a scratch arena that is reset after every
+// statement, so evaluation itself does not call malloc.
+//
 
 void execute(struct STMT *program, struct RAM *memory)
 {
     struct STMT *stmt = program;
+    struct ARENA scratch;
+
+    arena_init(&scratch);
 
     while (stmt != NULL)
     {
         if (stmt->stmt_type == STMT_ASSIGNMENT)
         {
-            bool success = execute_assignment(stmt, memory);
+            bool success = execute_assignment(stmt, memory, &scratch);
             if (!success)
             {
-                return;
+                break;
             }
             stmt = stmt->types.assignment->next_stmt;
         }
         else if (stmt->stmt_type == STMT_FUNCTION_CALL)
         {
-            bool success = execute_function_call(stmt, memory);
+            bool success = execute_function_call(stmt, memory, &scratch);
             if (!success)
             {
-                return;
+                break;
             }
             stmt = stmt->types.function_call->next_stmt;
         }
@@ -1226,28 +1433,33 @@ void execute(struct STMT *program, struct RAM *memory)
         }
         else if (stmt->stmt_type == STMT_IF_THEN_ELSE)
         {
-            struct STMT *next_stmt;                                   // Declare a local variable
-            bool success = execute_if_stmt(stmt, memory, &next_stmt); // Pass ADDRESS
+            struct STMT *next_stmt;                                             // Declare a local variable
+            bool success = execute_if_stmt(stmt, memory, &scratch, &next_stmt); // Pass ADDRESS
             if (!success)
             {
-                return;
+                break;
             }
             stmt = next_stmt; // Use the value set by the function
         }
         else if (stmt->stmt_type == STMT_WHILE_LOOP)
         {
-            struct STMT *next_stmt;                                      // Declare a local variable
-            bool success = execute_while_loop(stmt, memory, &next_stmt); // Pass ADDRESS
+            struct STMT *next_stmt;                                                // Declare a local variable
+            bool success = execute_while_loop(stmt, memory, &scratch, &next_stmt); // Pass ADDRESS
             if (!success)
             {
-                return;
+                break;
             }
             stmt = next_stmt; // Use the value set by the function
         }
         else
         {
             printf("**SEMANTIC ERROR: unknown statement type\n");
-            return;
+            break;
         }
+
+        // statement is done, release its temporaries
+        arena_reset(&scratch);
     }
-}
\ No newline at end of file
+
+    arena_destroy(&scratch);
+}
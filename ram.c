@@ -0,0 +1,291 @@
+/*ram.c*/
+
+//
+// Random access memory (RAM) for nuPython
+//
+// Prof. Joe Hummel
+// Northwestern University
+// CS 211
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>  // true, false
+#include <string.h>
+#include <inttypes.h> // PRId64
+
+#include "ram.h"
+#include "bigint.h"
+
+
+//
+// Private functions:
+//
+
+//
+// panic
+//
+// Outputs the given error message and exits the program.
+//
+static void panic(char* msg)
+{
+  printf("**RAM ERROR\n");
+  printf("**RAM ERROR: %s\n", msg);
+  printf("**RAM ERROR\n");
+  exit(-123);
+}
+
+//
+// dupString
+//
+// Returns a dynamically-allocated copy of the given string.
+//
+static char* dupString(char* s)
+{
+  if (s == NULL)
+    panic("s is NULL (dupString)");
+
+  char* copy = malloc(strlen(s) + 1);
+  if (copy == NULL)
+    panic("out of memory (dupString)");
+
+  strcpy(copy, s);
+
+  return copy;
+}
+
+//
+// copy_value
+//
+// Copies the given value into the destination; strings and big
+// integers are duplicated so memory owns its own copy.
+//
+static void copy_value(struct RAM_VALUE* dest, struct RAM_VALUE value)
+{
+  *dest = value;
+
+  if (value.value_type == RAM_TYPE_STR)
+    dest->types.s = dupString(value.types.s);
+  else if (value.value_type == RAM_TYPE_BIGINT)
+    dest->types.b = bigint_dup(value.types.b);
+}
+
+//
+// release_value
+//
+// Frees the storage owned by the given value, if any.
+//
+static void release_value(struct RAM_VALUE* value)
+{
+  if (value->value_type == RAM_TYPE_STR)
+    free(value->types.s);
+  else if (value->value_type == RAM_TYPE_BIGINT)
+    bigint_free(value->types.b);
+}
+
+//
+// find_identifier
+//
+// Returns the address of the given identifier, -1 if not found.
+//
+static int find_identifier(struct RAM* memory, char* identifier)
+{
+  for (int i = 0; i < memory->num_values; i++)
+  {
+    if (strcmp(memory->cells[i].identifier, identifier) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+
+//
+// Public functions:
+//
+
+struct RAM* ram_init(void)
+{
+  struct RAM* memory = malloc(sizeof(struct RAM));
+  if (memory == NULL)
+    panic("out of memory (ram_init)");
+
+  memory->num_values = 0;
+  memory->capacity = 4;
+  memory->cells = malloc(sizeof(struct RAM_CELL) * memory->capacity);
+  if (memory->cells == NULL)
+    panic("out of memory (ram_init)");
+
+  for (int i = 0; i < memory->capacity; i++)
+  {
+    memory->cells[i].identifier = NULL;
+    memory->cells[i].value.value_type = RAM_TYPE_NONE;
+  }
+
+  return memory;
+}
+
+void ram_destroy(struct RAM* memory)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_destroy)");
+
+  for (int i = 0; i < memory->num_values; i++)
+  {
+    free(memory->cells[i].identifier);
+    release_value(&memory->cells[i].value);
+  }
+
+  free(memory->cells);
+  free(memory);
+}
+
+int ram_get_addr(struct RAM* memory, char* identifier)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_get_addr)");
+
+  return find_identifier(memory, identifier);
+}
+
+struct RAM_VALUE* ram_read_cell_by_addr(struct RAM* memory, int address)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_read_cell_by_addr)");
+
+  if (address < 0 || address >= memory->num_values)
+    return NULL;
+
+  struct RAM_VALUE* value = malloc(sizeof(struct RAM_VALUE));
+  if (value == NULL)
+    panic("out of memory (ram_read_cell_by_addr)");
+
+  copy_value(value, memory->cells[address].value);
+
+  return value;
+}
+
+struct RAM_VALUE* ram_read_cell_by_name(struct RAM* memory, char* name)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_read_cell_by_name)");
+  if (name == NULL)
+    panic("identifier ptr is null (ram_read_cell_by_name)");
+
+  return ram_read_cell_by_addr(memory, find_identifier(memory, name));
+}
+
+void ram_free_value(struct RAM_VALUE* value)
+{
+  if (value == NULL)
+    return;
+
+  release_value(value);
+  free(value);
+}
+
+bool ram_write_cell_by_addr(struct RAM* memory, struct RAM_VALUE value, int address)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_write_cell_by_addr)");
+
+  if (address < 0 || address >= memory->num_values)
+    return false;
+
+  //
+  // copy before releasing the old value, which the new value
+  // may have been borrowed from:
+  //
+  struct RAM_VALUE old = memory->cells[address].value;
+
+  copy_value(&memory->cells[address].value, value);
+  release_value(&old);
+
+  return true;
+}
+
+bool ram_write_cell_by_name(struct RAM* memory, struct RAM_VALUE value, char* name)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_write_cell_by_name)");
+  if (name == NULL)
+    panic("identifier ptr is null (ram_write_cell_by_name)");
+
+  int address = find_identifier(memory, name);
+
+  if (address < 0)  // new variable:
+  {
+    if (memory->num_values == memory->capacity)  // full, double capacity:
+    {
+      memory->capacity *= 2;
+      memory->cells = realloc(memory->cells, sizeof(struct RAM_CELL) * memory->capacity);
+      if (memory->cells == NULL)
+        panic("out of memory (ram_write_cell_by_name)");
+
+      for (int i = memory->num_values; i < memory->capacity; i++)
+      {
+        memory->cells[i].identifier = NULL;
+        memory->cells[i].value.value_type = RAM_TYPE_NONE;
+      }
+    }
+
+    address = memory->num_values;
+    memory->num_values++;
+    memory->cells[address].identifier = dupString(name);
+  }
+
+  return ram_write_cell_by_addr(memory, value, address);
+}
+
+void ram_print(struct RAM* memory)
+{
+  if (memory == NULL)
+    panic("memory ptr is null (ram_print)");
+
+  printf("**MEMORY PRINT**\n");
+  printf("Capacity: %d\n", memory->capacity);
+  printf("Num values: %d\n", memory->num_values);
+  printf("Contents:\n");
+
+  for (int i = 0; i < memory->num_values; i++)
+  {
+    struct RAM_VALUE* value = &memory->cells[i].value;
+
+    printf(" %d: %s, ", i, memory->cells[i].identifier);
+
+    switch (value->value_type)
+    {
+    case RAM_TYPE_INT:
+      printf("int, %" PRId64, value->types.i);
+      break;
+    case RAM_TYPE_REAL:
+      printf("real, %lf", value->types.d);
+      break;
+    case RAM_TYPE_STR:
+      printf("str, '%s'", value->types.s);
+      break;
+    case RAM_TYPE_PTR:
+      printf("ptr, %" PRId64, value->types.i);
+      break;
+    case RAM_TYPE_BOOLEAN:
+      if (value->types.i == 0)
+        printf("boolean, False");
+      else
+        printf("boolean, True");
+      break;
+    case RAM_TYPE_NONE:
+      printf("none, None");
+      break;
+    case RAM_TYPE_BIGINT:
+      printf("int, ");
+      bigint_print(value->types.b, stdout);
+      break;
+    default:
+      panic("unknown ram value type?! (ram_print)");
+    }
+
+    printf("\n");
+  }
+
+  printf("**END PRINT**\n");
+}
@@ -11,6 +11,9 @@
 #pragma once
 
 #include <stdbool.h>  // true, false
+#include <stdint.h>   // int64_t
+
+struct BIGINT;  // see bigint.h
 
 
 //
@@ -23,7 +26,8 @@ enum RAM_VALUE_TYPES
   RAM_TYPE_STR,
   RAM_TYPE_PTR,
   RAM_TYPE_BOOLEAN,
-  RAM_TYPE_NONE
+  RAM_TYPE_NONE,
+  RAM_TYPE_BIGINT   // an int that does not fit in 64 bits
 };
 
 struct RAM_VALUE
@@ -38,9 +42,10 @@ struct RAM_VALUE
   //
   union
   {
-    int    i; // INT, PTR, BOOLEAN
-    double d; // REAL
-    char*  s; // STR 
+    int64_t i; // INT, PTR, BOOLEAN
+    double  d; // REAL
+    char*   s; // STR 
+    struct BIGINT* b; // BIGINT
   } types;
 };
 
@@ -144,8 +149,9 @@ void ram_free_value(struct RAM_VALUE* value);
 // the value was successfully written, false if not (which 
 // implies the memory address is invalid).
 // 
-// NOTE: if the value being written is a string, it will
-// be duplicated and stored.
+// NOTE: if the value being written is a string or a big
+// integer, it will be duplicated and stored. The value may
+// be borrowed from the cell being overwritten (e.g. x = x).
 // 
 // NOTE: a variable has to be written to memory before its
 // address becomes valid. Once a variable is written to memory,
@@ -161,8 +167,8 @@ bool ram_write_cell_by_addr(struct RAM* memory, struct RAM_VALUE value, int addr
 // existing value is overwritten by this new value. Returns
 // true since this operation always succeeds.
 // 
-// NOTE: if the value being written is a string, it will
-// be duplicated and stored.
+// NOTE: if the value being written is a string or a big
+// integer, it will be duplicated and stored.
 // 
 // NOTE: a variable has to be written to memory before its
 // address becomes valid. Once a variable is written to memory,